@@ -556,6 +556,401 @@ NAPI_EXTERN napi_status napi_object_seal(napi_env env,
                                          napi_value object);
 #endif  // NAPI_VERSION >= 8
 
+#ifdef NAPI_EXPERIMENTAL
+
+// Bulk named properties
+// Creates an object with all properties set in a single pass, so the engine
+// can pick the final object shape up front.
+NAPI_EXTERN napi_status
+node_api_create_object_with_named_properties(napi_env env,
+                                             size_t property_count,
+                                             const char** utf8names,
+                                             const napi_value* values,
+                                             napi_value* result);
+// Properties are set, or read, in array order. A NULL entry in utf8names
+// fails with napi_invalid_arg before any property is accessed. If a setter
+// or getter throws, the call stops and returns napi_pending_exception. The
+// properties before the throwing one have been set, or written to values.
+// The properties from the throwing one onwards are not set, and their
+// entries in values are left unchanged.
+NAPI_EXTERN napi_status
+node_api_set_named_properties(napi_env env,
+                              napi_value object,
+                              size_t property_count,
+                              const char** utf8names,
+                              const napi_value* values);
+NAPI_EXTERN napi_status
+node_api_get_named_properties(napi_env env,
+                              napi_value object,
+                              size_t property_count,
+                              const char** utf8names,
+                              napi_value* values);
+
+// Object templates
+// A template fixes the property names, and their order, of the objects
+// created from it. It is not tied to a handle scope and stays valid until
+// it is deleted.
+NAPI_EXTERN napi_status
+node_api_create_object_template(napi_env env,
+                                size_t property_count,
+                                const char** utf8names,
+                                node_api_object_template* result);
+NAPI_EXTERN napi_status
+node_api_delete_object_template(napi_env env,
+                                node_api_object_template object_template);
+// values must hold one entry per property name of the template.
+NAPI_EXTERN napi_status
+node_api_create_object_from_template(napi_env env,
+                                     node_api_object_template object_template,
+                                     const napi_value* values,
+                                     napi_value* result);
+
+// Property keys
+// A property key holds an interned property name. Like a napi_ref, it
+// outlives handle scopes and stays valid until it is deleted.
+NAPI_EXTERN napi_status
+node_api_create_property_key(napi_env env,
+                             const char* utf8name,
+                             size_t length,
+                             node_api_property_key* result);
+NAPI_EXTERN napi_status node_api_delete_property_key(napi_env env,
+                                                     node_api_property_key key);
+NAPI_EXTERN napi_status node_api_set_property_by_key(napi_env env,
+                                                     napi_value object,
+                                                     node_api_property_key key,
+                                                     napi_value value);
+NAPI_EXTERN napi_status node_api_has_property_by_key(napi_env env,
+                                                     napi_value object,
+                                                     node_api_property_key key,
+                                                     bool* result);
+NAPI_EXTERN napi_status node_api_get_property_by_key(napi_env env,
+                                                     napi_value object,
+                                                     node_api_property_key key,
+                                                     napi_value* result);
+NAPI_EXTERN napi_status
+node_api_delete_property_by_key(napi_env env,
+                                napi_value object,
+                                node_api_property_key key,
+                                bool* result);
+
+// External strings
+// The engine takes ownership of str and calls finalize_callback once the
+// string is collected. Short strings may be copied instead, in which case
+// *copied is set to true and finalize_callback has already been called.
+NAPI_EXTERN napi_status
+node_api_create_external_string_latin1(napi_env env,
+                                       char* str,
+                                       size_t length,
+                                       napi_finalize finalize_callback,
+                                       void* finalize_hint,
+                                       napi_value* result,
+                                       bool* copied);
+NAPI_EXTERN napi_status
+node_api_create_external_string_utf16(napi_env env,
+                                      char16_t* str,
+                                      size_t length,
+                                      napi_finalize finalize_callback,
+                                      void* finalize_hint,
+                                      napi_value* result,
+                                      bool* copied);
+
+// Exposes the engine's own representation of a string without copying or
+// transcoding it. A string that is not stored contiguously, such as a
+// concatenation or a slice, is flattened first, which allocates. The view is
+// read-only and stays valid only until the next N-API call on any env of
+// the same engine instance, because that call may allocate or run
+// JavaScript and move the string.
+NAPI_EXTERN napi_status
+node_api_get_value_string_view(napi_env env,
+                               napi_value value,
+                               node_api_string_view* result);
+
+// Same contract as napi_get_value_string_utf8, with copied in place of
+// result: if buf is NULL, nothing is copied and copied is set to 0. Otherwise
+// at most bufsize - 1 bytes are copied, buf is NUL-terminated, truncation
+// never splits a multi-byte sequence, and copied receives the number of bytes
+// written, excluding the terminator. In addition, total_length receives the
+// full UTF-8 length of the string, excluding the terminator, so that a caller
+// whose buffer is large enough needs a single call instead of a size query
+// followed by a copy.
+NAPI_EXTERN napi_status
+node_api_get_value_string_utf8_with_length(napi_env env,
+                                           napi_value value,
+                                           char* buf,
+                                           size_t bufsize,
+                                           size_t* copied,
+                                           size_t* total_length);
+
+// Fast calls
+// The engine calls fast_call->function directly with unboxed arguments when
+// the actual arguments match the declared signature, and falls back to cb
+// otherwise.
+NAPI_EXTERN napi_status
+node_api_create_function_with_fast_call(
+    napi_env env,
+    const char* utf8name,
+    size_t length,
+    napi_callback cb,
+    const node_api_fast_call_descriptor* fast_call,
+    void* data,
+    napi_value* result);
+
+// Class options
+// Like napi_define_class, with additional per-class options. A NULL options
+// is the same as calling napi_define_class.
+NAPI_EXTERN napi_status
+node_api_define_class_with_options(napi_env env,
+                                   const char* utf8name,
+                                   size_t length,
+                                   napi_callback constructor,
+                                   void* data,
+                                   size_t property_count,
+                                   const napi_property_descriptor* properties,
+                                   const node_api_class_options* options,
+                                   napi_value* result);
+
+// Resizable ArrayBuffers
+// The address range for max_byte_length is reserved up front, so data stays
+// valid and the buffer grows in place without copying.
+NAPI_EXTERN napi_status
+node_api_create_resizable_arraybuffer(napi_env env,
+                                      size_t byte_length,
+                                      size_t max_byte_length,
+                                      void** data,
+                                      napi_value* result);
+NAPI_EXTERN napi_status
+node_api_is_resizable_arraybuffer(napi_env env,
+                                  napi_value value,
+                                  bool* result);
+// Fails with napi_arraybuffer_expected for values that are not ArrayBuffers,
+// and with napi_invalid_arg, leaving the buffer unchanged, if it is not
+// resizable, is detached, or new_byte_length exceeds max_byte_length.
+// Fixed-length typed arrays and DataViews that a shrink leaves out of bounds
+// report a length of 0 through napi_get_typedarray_info and
+// napi_get_dataview_info, as they do in JavaScript, until a later resize
+// brings them back in bounds.
+NAPI_EXTERN napi_status node_api_resize_arraybuffer(napi_env env,
+                                                    napi_value arraybuffer,
+                                                    size_t new_byte_length);
+// Returns the byte length for ArrayBuffers that are not resizable.
+NAPI_EXTERN napi_status
+node_api_get_arraybuffer_max_byte_length(napi_env env,
+                                         napi_value arraybuffer,
+                                         size_t* result);
+// Creates a typed array that covers the buffer from byte_offset to its end,
+// and whose length follows the buffer as it is resized.
+NAPI_EXTERN napi_status
+node_api_create_length_tracking_typedarray(napi_env env,
+                                           napi_typedarray_type type,
+                                           napi_value arraybuffer,
+                                           size_t byte_offset,
+                                           napi_value* result);
+
+// SharedArrayBuffers
+// napi_create_typedarray and napi_create_dataview keep rejecting anything
+// that is not an ArrayBuffer; views over a SharedArrayBuffer are created with
+// node_api_create_shared_typedarray and node_api_create_shared_dataview.
+// For such views, napi_get_typedarray_info and napi_get_dataview_info return
+// the SharedArrayBuffer in their arraybuffer out-param. napi_is_arraybuffer
+// reports false for it and napi_get_arraybuffer_info rejects it, so callers
+// check node_api_is_sharedarraybuffer and use
+// node_api_get_sharedarraybuffer_info instead.
+NAPI_EXTERN napi_status node_api_is_sharedarraybuffer(napi_env env,
+                                                      napi_value value,
+                                                      bool* result);
+NAPI_EXTERN napi_status
+node_api_create_sharedarraybuffer(napi_env env,
+                                  size_t byte_length,
+                                  void** data,
+                                  napi_value* result);
+// The memory may be shared with other isolates, so finalize_cb is called once
+// all of them have released it, possibly on another thread and with a NULL
+// env.
+NAPI_EXTERN napi_status
+node_api_create_external_sharedarraybuffer(napi_env env,
+                                           void* external_data,
+                                           size_t byte_length,
+                                           napi_finalize finalize_cb,
+                                           void* finalize_hint,
+                                           napi_value* result);
+NAPI_EXTERN napi_status
+node_api_get_sharedarraybuffer_info(napi_env env,
+                                    napi_value sharedarraybuffer,
+                                    void** data,
+                                    size_t* byte_length);
+NAPI_EXTERN napi_status
+node_api_create_shared_typedarray(napi_env env,
+                                  napi_typedarray_type type,
+                                  size_t length,
+                                  napi_value sharedarraybuffer,
+                                  size_t byte_offset,
+                                  napi_value* result);
+NAPI_EXTERN napi_status
+node_api_create_shared_dataview(napi_env env,
+                                size_t length,
+                                napi_value sharedarraybuffer,
+                                size_t byte_offset,
+                                napi_value* result);
+
+// Typed arrays over native memory
+// Creates a typed array of length elements over external_data, together with
+// its underlying ArrayBuffer, which keeps the memory alive until the last
+// view is collected. As with napi_create_typedarray, external_data must be
+// aligned to the element size of type, otherwise the call fails with
+// napi_invalid_arg and a RangeError is thrown. A NULL external_data with a
+// non-zero length fails with napi_invalid_arg. A length of 0 creates an
+// empty typed array, and finalize_cb, if any, is still called when it is
+// collected.
+NAPI_EXTERN napi_status
+node_api_create_external_typedarray(napi_env env,
+                                    napi_typedarray_type type,
+                                    void* external_data,
+                                    size_t length,
+                                    napi_finalize finalize_cb,
+                                    void* finalize_hint,
+                                    napi_value* result);
+// Like napi_get_typedarray_info, but only returns the data pointer and the
+// length in elements.
+NAPI_EXTERN napi_status node_api_get_typedarray_data(napi_env env,
+                                                     napi_value typedarray,
+                                                     void** data,
+                                                     size_t* length);
+
+// Bulk array elements
+// The functions that read a range take an Array; other values, including
+// typed arrays and array-likes, fail with napi_array_expected. A range whose
+// start + count is past the array length fails with napi_invalid_arg and
+// writes nothing.
+
+// Copies count elements starting at start into result. Elements are read as
+// napi_get_element reads them, so holes read as undefined.
+NAPI_EXTERN napi_status node_api_get_elements(napi_env env,
+                                              napi_value array,
+                                              uint32_t start,
+                                              uint32_t count,
+                                              napi_value* result);
+NAPI_EXTERN napi_status
+node_api_create_array_from_values(napi_env env,
+                                  size_t count,
+                                  const napi_value* values,
+                                  napi_value* result);
+// Copies count numeric elements starting at start into result, converted as
+// napi_get_value_double and napi_get_value_int32 convert them. Fails with
+// napi_number_expected if an element in the range is a hole or not a number,
+// in which case the contents of result are unspecified.
+NAPI_EXTERN napi_status node_api_array_to_float64(napi_env env,
+                                                  napi_value array,
+                                                  uint32_t start,
+                                                  uint32_t count,
+                                                  double* result);
+NAPI_EXTERN napi_status node_api_array_to_int32(napi_env env,
+                                                napi_value array,
+                                                uint32_t start,
+                                                uint32_t count,
+                                                int32_t* result);
+
+// Internal fields
+// These access the internal fields reserved through
+// node_api_class_options.internal_field_count. index counts from the first
+// field after the napi_wrap slot, which cannot be reached through these
+// calls. Fails with napi_invalid_arg if index is not below the class's
+// internal_field_count.
+NAPI_EXTERN napi_status node_api_get_internal_field(napi_env env,
+                                                    napi_value js_object,
+                                                    size_t index,
+                                                    void** result);
+NAPI_EXTERN napi_status node_api_set_internal_field(napi_env env,
+                                                    napi_value js_object,
+                                                    size_t index,
+                                                    void* value);
+#if NAPI_VERSION >= 8
+// Combines napi_check_object_type_tag and napi_unwrap. Fails with
+// napi_invalid_arg if js_object is not tagged with type_tag.
+NAPI_EXTERN napi_status node_api_unwrap_tagged(napi_env env,
+                                               napi_value js_object,
+                                               const napi_type_tag* type_tag,
+                                               void** result);
+#endif  // NAPI_VERSION >= 8
+
+// Creates an instance of a class defined with napi_define_class or
+// node_api_define_class_with_options without running its constructor
+// callback. The instance gets the class prototype and native_object is
+// wrapped in it as if by napi_wrap.
+NAPI_EXTERN napi_status node_api_create_instance(napi_env env,
+                                                 napi_value constructor,
+                                                 void* native_object,
+                                                 napi_finalize finalize_cb,
+                                                 void* finalize_hint,
+                                                 napi_value* result);
+
+// Reference pools
+// References created from a pool are stored in contiguous slabs and behave
+// like those from napi_create_reference. They may also be deleted one at a
+// time with napi_delete_reference. Deleting the pool deletes all of the
+// references still in it.
+NAPI_EXTERN napi_status
+node_api_create_reference_pool(napi_env env,
+                               size_t initial_capacity,
+                               node_api_reference_pool* result);
+NAPI_EXTERN napi_status
+node_api_delete_reference_pool(napi_env env, node_api_reference_pool pool);
+NAPI_EXTERN napi_status
+node_api_create_references(napi_env env,
+                           node_api_reference_pool pool,
+                           size_t count,
+                           const napi_value* values,
+                           uint32_t initial_refcount,
+                           napi_ref* result);
+NAPI_EXTERN napi_status
+node_api_delete_references(napi_env env,
+                           node_api_reference_pool pool,
+                           size_t count,
+                           const napi_ref* refs);
+
+// Deferred finalizers
+// Queues finalize_cb to run on the loop after the current garbage collection
+// has finished, where it may call into JavaScript. May be called from within
+// a finalizer to move expensive work out of the GC pause.
+NAPI_EXTERN napi_status node_api_post_finalizer(napi_env env,
+                                                napi_finalize finalize_cb,
+                                                void* finalize_data,
+                                                void* finalize_hint);
+// Limits the time spent draining posted finalizers in a single loop turn.
+// Finalizers that do not fit are left for the next turn. 0 removes the limit.
+NAPI_EXTERN napi_status
+node_api_set_finalizer_drain_budget(napi_env env, uint64_t budget_us);
+
+// Memory pressure
+// Listeners are called on the JavaScript thread of env, at a time that
+// depends on the level:
+//  - node_api_memory_pressure_moderate is delivered on the loop after the
+//    garbage collection that detected it. The listener may call into
+//    JavaScript and allocate, but is not guaranteed to run before the next
+//    full garbage collection.
+//  - node_api_memory_pressure_critical is delivered synchronously when the
+//    heap nears its limit, before the engine gives up with an out-of-memory
+//    error, even if JavaScript never yields to the loop. As in a finalizer
+//    run during garbage collection, the listener must not call into
+//    JavaScript or allocate JavaScript values; it may only free native
+//    memory, e.g. shed cache entries and report them through
+//    napi_adjust_external_memory.
+NAPI_EXTERN napi_status
+node_api_add_memory_pressure_listener(napi_env env,
+                                      node_api_memory_pressure_callback cb,
+                                      void* data);
+NAPI_EXTERN napi_status
+node_api_remove_memory_pressure_listener(napi_env env,
+                                         node_api_memory_pressure_callback cb,
+                                         void* data);
+// Returns the external memory currently attributed to this env: the sum of
+// its napi_adjust_external_memory calls, plus any external memory that the
+// runtime's own APIs allocate on its behalf, each counted until it is
+// released.
+NAPI_EXTERN napi_status node_api_get_external_memory(napi_env env,
+                                                     int64_t* result);
+
+#endif  // NAPI_EXPERIMENTAL
+
 EXTERN_C_END
 
 #endif  // SRC_JS_NATIVE_API_H_
@@ -160,4 +160,86 @@ typedef struct {
 } napi_type_tag;
 #endif  // NAPI_VERSION >= 8
 
+#ifdef NAPI_EXPERIMENTAL
+typedef struct node_api_object_template__* node_api_object_template;
+typedef struct node_api_property_key__* node_api_property_key;
+typedef struct node_api_reference_pool__* node_api_reference_pool;
+
+typedef enum {
+  node_api_string_latin1,
+  node_api_string_utf16
+} node_api_string_encoding;
+
+typedef struct {
+  // Points to length Latin-1 bytes or length UTF-16 code units, depending
+  // on encoding. The data is not NUL-terminated.
+  const void* data;
+  size_t length;
+  node_api_string_encoding encoding;
+} node_api_string_view;
+
+// An argument only takes the fast path when it converts without loss:
+// bool accepts booleans; int32, uint32, int64 and uint64 accept Numbers with
+// an integral value in range and, for the 64-bit types, BigInts in range;
+// float32 and float64 accept any Number, rounded to nearest for float32.
+// Any other argument makes the call take the regular callback. 64-bit
+// integer results are returned as BigInts, like napi_create_bigint_int64.
+typedef enum {
+  node_api_fast_type_void,
+  node_api_fast_type_bool,
+  node_api_fast_type_int32,
+  node_api_fast_type_uint32,
+  node_api_fast_type_int64,
+  node_api_fast_type_uint64,
+  node_api_fast_type_float32,
+  node_api_fast_type_float64,
+  // Passed as a const node_api_fast_typedarray*. Argument only.
+  node_api_fast_type_typedarray
+} node_api_fast_type;
+
+typedef struct {
+  void* data;
+  size_t length;
+  napi_typedarray_type type;
+} node_api_fast_typedarray;
+
+// The engine does not copy the descriptor or arg_types. Both must stay valid
+// for as long as any function created from them exists, and are usually
+// static.
+typedef struct {
+  // C function whose signature is described by return_type and arg_types,
+  // with one leading void* parameter. For instance methods of a class, that
+  // parameter receives the native object wrapped in the receiver, and calls
+  // whose receiver has no wrapped object take the regular callback instead.
+  // Otherwise it receives the data pointer given when the function was
+  // created. The function must not call back into JavaScript.
+  void (*function)(void);
+  node_api_fast_type return_type;
+  // Number of entries in arg_types, not counting the leading void*.
+  size_t arg_count;
+  const node_api_fast_type* arg_types;
+} node_api_fast_call_descriptor;
+
+typedef struct {
+  // Number of native pointer slots reserved in each instance in addition to
+  // the one used by napi_wrap, napi_unwrap and napi_remove_wrap, which then
+  // access that slot directly and keep the type tag alongside it. 0 is valid
+  // and reserves only the napi_wrap slot.
+  size_t internal_field_count;
+  // Either NULL, meaning no fast calls, or one entry per property descriptor.
+  // Entries may be NULL, and are ignored for properties that are not methods.
+  const node_api_fast_call_descriptor* const* fast_calls;
+} node_api_class_options;
+
+typedef enum {
+  node_api_memory_pressure_moderate,
+  node_api_memory_pressure_critical
+} node_api_memory_pressure_level;
+
+typedef void (*node_api_memory_pressure_callback)(
+    napi_env env,
+    node_api_memory_pressure_level level,
+    void* data);
+#endif  // NAPI_EXPERIMENTAL
+
 #endif  // SRC_JS_NATIVE_API_TYPES_H_
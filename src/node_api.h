@@ -246,6 +246,71 @@ napi_unref_threadsafe_function(napi_env env, napi_threadsafe_function func);
 
 NAPI_EXTERN napi_status
 napi_ref_threadsafe_function(napi_env env, napi_threadsafe_function func);
+
+#ifdef NAPI_EXPERIMENTAL
+// Like napi_create_threadsafe_function, but each turn of the event loop
+// drains up to max_batch_size queued items and passes them to call_js_cb
+// together, paying for a single handle scope, callback scope and microtask
+// checkpoint per batch instead of per item. A max_batch_size of 0 drains
+// every item queued at the start of the turn. There is no default for
+// call_js_cb: passing NULL fails with napi_invalid_arg.
+NAPI_EXTERN napi_status
+node_api_create_threadsafe_function_batched(
+    napi_env env,
+    napi_value func,
+    napi_value async_resource,
+    napi_value async_resource_name,
+    size_t max_queue_size,
+    size_t max_batch_size,
+    size_t initial_thread_count,
+    void* thread_finalize_data,
+    napi_finalize thread_finalize_cb,
+    void* context,
+    node_api_threadsafe_function_call_js_batch call_js_cb,
+    napi_threadsafe_function* result);
+
+// May be called from any thread. Does not block producers.
+NAPI_EXTERN napi_status
+node_api_get_threadsafe_function_stats(
+    napi_threadsafe_function func,
+    node_api_threadsafe_function_stats* result);
+
+// Creates a promise whose deferred may be settled from any thread.
+// Settlements are delivered to the loop in batches, one wakeup for all of
+// the settlements pending at that time. If convert_cb throws, the promise is
+// rejected with the exception. Like a threadsafe function that has not been
+// unref'd, a pending threadsafe deferred keeps the event loop alive until it
+// is settled.
+//
+// As with napi_acquire_threadsafe_function, the deferred is freed once all
+// of its users are done with it. The creating thread is its first user.
+// Each further thread that may settle it is added by an existing user
+// calling node_api_acquire_threadsafe_deferred before handing the deferred
+// over. A resolve or reject call ends
+// the caller's use, as does node_api_release_threadsafe_deferred for a
+// thread that will not settle. The first settlement wins and takes ownership
+// of its data. Later settlements fail with napi_closing; their data is not
+// touched and stays owned by the caller. If every user is done without
+// settling, the promise is rejected with an Error.
+NAPI_EXTERN napi_status
+node_api_create_threadsafe_promise(napi_env env,
+                                   node_api_threadsafe_deferred* deferred,
+                                   napi_value* promise);
+NAPI_EXTERN napi_status
+node_api_acquire_threadsafe_deferred(node_api_threadsafe_deferred deferred);
+NAPI_EXTERN napi_status
+node_api_release_threadsafe_deferred(node_api_threadsafe_deferred deferred);
+NAPI_EXTERN napi_status
+node_api_resolve_threadsafe_deferred(
+    node_api_threadsafe_deferred deferred,
+    void* data,
+    node_api_threadsafe_deferred_convert convert_cb);
+NAPI_EXTERN napi_status
+node_api_reject_threadsafe_deferred(
+    node_api_threadsafe_deferred deferred,
+    void* data,
+    node_api_threadsafe_deferred_convert convert_cb);
+#endif  // NAPI_EXPERIMENTAL
 #endif  // __wasm32__
 
 #endif  // NAPI_VERSION >= 4
@@ -268,6 +333,102 @@ NAPI_EXTERN napi_status napi_remove_async_cleanup_hook(
 NAPI_EXTERN napi_status
 node_api_get_module_file_name(napi_env env, const char** result);
 
+// Queues work in the given priority class. Each class has its own queue.
+// Workers are reserved for the immediate and user-initiated classes, and
+// lower classes are still scheduled periodically so they do not starve.
+// napi_queue_async_work is equivalent to node_api_priority_default.
+NAPI_EXTERN napi_status
+node_api_queue_async_work_with_priority(napi_env env,
+                                        napi_async_work work,
+                                        node_api_async_work_priority priority);
+
+// Splits the elements of a typed array, or the bytes of a DataView or an
+// ArrayBuffer, into chunks of at least grain_size and runs kernel over them
+// on a work-stealing pool. For views only the viewed range is covered.
+// complete is called once on the loop thread after every chunk has finished.
+// The buffer cannot be detached until then. Resizable ArrayBuffers, and views
+// over them, are rejected with napi_invalid_arg, so the range cannot shrink
+// under a running kernel. SharedArrayBuffers, and views over them, are
+// accepted; keeping other threads from racing with the kernels is up to the
+// caller. Any other value fails with napi_arraybuffer_expected.
+NAPI_EXTERN napi_status
+node_api_parallel_for(napi_env env,
+                      napi_value buffer,
+                      size_t grain_size,
+                      node_api_parallel_for_kernel kernel,
+                      napi_async_complete_callback complete,
+                      void* data);
+
+// Makes successor wait for work. The items linked this way form a graph.
+// Calling napi_queue_async_work on any item of the graph queues all of its
+// items; queuing another item of the same graph afterwards does nothing.
+// An item starts directly on a worker thread once all of its dependencies
+// have run. The complete callbacks of the whole graph are deferred until its
+// last item has run, then called in dependency order in a single loop turn.
+// If a dependency is cancelled, its successors complete with napi_cancelled.
+// While the graph is queued it keeps the loop alive, and napi_delete_async_work
+// on any of its items fails with napi_invalid_arg. Deleting an item of a
+// graph that has not been queued removes its links. Linking an item that is
+// already queued, or a link that would form a cycle, fails with
+// napi_invalid_arg and leaves the graph unchanged.
+NAPI_EXTERN napi_status node_api_async_work_then(napi_env env,
+                                                 napi_async_work work,
+                                                 napi_async_work successor);
+
+// Memory-maps length bytes of the file at path, starting at offset, and
+// returns them as an ArrayBuffer. Pass NAPI_AUTO_LENGTH to map up to the end
+// of the file. The mapping is always private and copy-on-write, so writes
+// from JavaScript are allowed and never reach the file. offset need not be
+// page-aligned: the mapping starts at the enclosing page boundary and the
+// ArrayBuffer starts exactly at offset. flags is a combination of
+// node_api_file_mapping_flags; passing both advise_sequential and
+// advise_random fails with napi_invalid_arg. The mapped length is reported
+// as external memory and counts towards node_api_get_external_memory for env
+// until the mapping is unmapped, when the ArrayBuffer is collected.
+//
+// A negative offset, an offset past the end of the file, or a range that
+// extends past the end of the file fails with napi_invalid_arg. A length of
+// 0, or NAPI_AUTO_LENGTH at the end of the file (including for an empty
+// file), returns an empty ArrayBuffer without mapping anything.
+//
+// Later writes to the file by other processes may or may not be visible in
+// pages that have not been copied yet. If the file is truncated while it is
+// mapped, accessing a page past the new end raises SIGBUS and terminates the
+// process, so only files that are not truncated while in use may be mapped.
+NAPI_EXTERN napi_status
+node_api_create_arraybuffer_from_file(napi_env env,
+                                      const char* path,
+                                      int64_t offset,
+                                      size_t length,
+                                      uint32_t flags,
+                                      napi_value* result);
+
+// Pooled buffers are carved out of shared slabs, like the Buffer pool on the
+// JavaScript side, so their underlying ArrayBuffer may be shared with other
+// buffers. A slab is freed once all buffers carved from it are collected.
+// The size of each slab counts towards node_api_get_external_memory for env
+// until it is freed.
+NAPI_EXTERN napi_status
+node_api_create_pooled_buffer(napi_env env,
+                              size_t length,
+                              void** data,
+                              napi_value* result);
+NAPI_EXTERN napi_status
+node_api_create_pooled_buffer_copy(napi_env env,
+                                   size_t length,
+                                   const void* data,
+                                   void** result_data,
+                                   napi_value* result);
+// Applies to slabs allocated after the call. Fails with napi_invalid_arg,
+// leaving the current config in place, if size_classes is not strictly
+// ascending or slab_size is smaller than the largest size class.
+NAPI_EXTERN napi_status
+node_api_set_buffer_pool_config(napi_env env,
+                                const node_api_buffer_pool_config* config);
+NAPI_EXTERN napi_status
+node_api_get_buffer_pool_stats(napi_env env,
+                               node_api_buffer_pool_stats* result);
+
 #endif  // NAPI_EXPERIMENTAL
 
 EXTERN_C_END
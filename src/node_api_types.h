@@ -18,7 +18,17 @@ typedef enum {
 
 typedef enum {
   napi_tsfn_nonblocking,
-  napi_tsfn_blocking
+  napi_tsfn_blocking,
+#ifdef NAPI_EXPERIMENTAL
+  // Replaces the item queued by the previous coalescing call if it has not
+  // been delivered yet, keeping its place in the queue. The replaced item is
+  // never called on the producer thread: it is passed to call_js_cb on the
+  // loop thread with a NULL env and js_callback so that it can be freed. For
+  // batched functions it is passed to the batch callback the same way. Never
+  // blocks: if there is no pending item to replace and the queue is full,
+  // the call fails with napi_queue_full.
+  node_api_tsfn_coalesce,
+#endif  // NAPI_EXPERIMENTAL
 } napi_threadsafe_function_call_mode;
 #endif  // NAPI_VERSION >= 4
 
@@ -32,6 +42,31 @@ typedef void (*napi_threadsafe_function_call_js)(napi_env env,
                                                  napi_value js_callback,
                                                  void* context,
                                                  void* data);
+#ifdef NAPI_EXPERIMENTAL
+// Receives up to max_batch_size queued items, in the order they were queued.
+// Like napi_threadsafe_function_call_js, it is always called on the loop
+// thread. Items still queued when the function is finalized are passed with
+// a NULL env and js_callback so that they can be freed.
+typedef void (*node_api_threadsafe_function_call_js_batch)(
+    napi_env env,
+    napi_value js_callback,
+    void* context,
+    void** data,
+    size_t count);
+
+typedef struct {
+  size_t queue_depth;
+  size_t queue_high_water_mark;
+  size_t max_queue_size;
+  uint64_t enqueued_count;
+  // Calls that failed with napi_queue_full.
+  uint64_t queue_full_count;
+  uint64_t delivered_count;
+  // Time from enqueue to delivery to JavaScript, in nanoseconds.
+  uint64_t total_drain_latency_ns;
+  uint64_t max_drain_latency_ns;
+} node_api_threadsafe_function_stats;
+#endif  // NAPI_EXPERIMENTAL
 #endif  // NAPI_VERSION >= 4
 
 typedef struct {
@@ -47,4 +82,58 @@ typedef void (*napi_async_cleanup_hook)(napi_async_cleanup_hook_handle handle,
                                         void* data);
 #endif  // NAPI_VERSION >= 8
 
+#ifdef NAPI_EXPERIMENTAL
+typedef enum {
+  node_api_priority_immediate,
+  node_api_priority_user_initiated,
+  node_api_priority_default,
+  node_api_priority_background
+} node_api_async_work_priority;
+
+// Runs on a worker thread for the elements [begin, end) of the buffer whose
+// first element is at buffer_data. Must not call into JavaScript.
+typedef void (*node_api_parallel_for_kernel)(void* buffer_data,
+                                             size_t begin,
+                                             size_t end,
+                                             void* data);
+
+typedef struct node_api_threadsafe_deferred__* node_api_threadsafe_deferred;
+// Converts the native payload of a settlement into the value the promise is
+// resolved or rejected with. Called on the loop thread, or with a NULL env if
+// the environment is torn down first, so that data can be freed.
+typedef napi_value (*node_api_threadsafe_deferred_convert)(napi_env env,
+                                                           void* data);
+
+// Access hints for node_api_create_arraybuffer_from_file, combined with |.
+// advise_sequential and advise_random are mutually exclusive.
+typedef enum {
+  node_api_file_mapping_default = 0,
+  node_api_file_mapping_advise_sequential = 1 << 0,
+  node_api_file_mapping_advise_random = 1 << 1,
+  node_api_file_mapping_advise_willneed = 1 << 2
+} node_api_file_mapping_flags;
+
+// Without a config, slabs are 8 KiB, like the JavaScript Buffer pool, and the
+// size classes are 16, 32, 64, 128, 256 and 512 bytes.
+typedef struct {
+  // Size of each slab in bytes. 0 selects the default.
+  size_t slab_size;
+  // Ascending allocation sizes that pooled buffers are rounded up to.
+  // Requests larger than the last size class are not pooled. A
+  // size_class_count of 0 selects the default size classes. The array is
+  // copied by node_api_set_buffer_pool_config.
+  size_t size_class_count;
+  const size_t* size_classes;
+} node_api_buffer_pool_config;
+
+typedef struct {
+  size_t slab_count;
+  size_t bytes_reserved;
+  size_t bytes_in_use;
+  uint64_t pooled_allocations;
+  // Allocations that were too large for the pool.
+  uint64_t unpooled_allocations;
+} node_api_buffer_pool_stats;
+#endif  // NAPI_EXPERIMENTAL
+
 #endif  // SRC_NODE_API_TYPES_H_